@@ -13,11 +13,17 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cmath>
+#include <cstdint>
 #include <ctime>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <sstream>
 
 using Color = glm::vec3;
@@ -55,12 +61,19 @@ struct Constants {
     static constexpr float ball_width = 0.05f / aspect_ratio;
     static constexpr float ball_height = 0.05f;
 
+    static constexpr int start_lives = 3;
+
     static constexpr int standard_value = 10;
     static constexpr Color standard_color = Color{0.8f, 0.2f, 0.1f};
 
     static constexpr int special_value = 25;
     static constexpr Color special_color = Color{0.9f, 0.9f, 0.1f};
 
+    static constexpr int prediction_max_bounces = 64;
+    static constexpr int headless_max_ticks = 2'000'000;
+
+    static constexpr uint32_t render_queue_capacity = 1024;
+
     static constexpr std::array<float, 12> square_vertices = {
         1.0f, -1.0f, 0.0f,
         1.0f, 0.0f, 0.0f,
@@ -153,11 +166,29 @@ struct Block {
 };
 struct GameState {
     int score = 0;
-    int lives = 3;
+    int lives = Constants::start_lives;
 
     std::array<std::array<Block, Constants::n_block_cols>, Constants::n_block_rows> blocks;
 };
 
+struct BlockIndex {
+    uint8_t row;
+    uint8_t col;
+};
+/*
+Cached result of predict_ball_landing. Only valid as long as the ball keeps travelling in `direction`
+by `step` per tick, the board doesn't change and none of the blocks in `path_blocks` (those the ball is
+predicted to bounce off) got destroyed.
+*/
+struct TrajectoryPrediction {
+    bool valid = false;
+    glm::vec2 direction{0.0f, 0.0f};
+    float step = 0.0f;
+    float landing_x = 0.0f;
+    int n_path_blocks = 0;
+    std::array<BlockIndex, Constants::prediction_max_bounces> path_blocks;
+};
+
 struct s_UBO {
     gl_UBO time;
     gl_UBO pos;
@@ -171,6 +202,50 @@ struct s_Color {
     Color paddle{1.0f, 0.0f, 0.0f};
 };
 
+enum class RenderLayer : uint8_t {
+    Paddle,
+    Ball,
+    Blocks
+};
+/*
+Sort key layout, most significant bits first: layer (8), shader program (16), VAO (16), material (24).
+Sorting by it draws layer by layer and puts commands sharing GL state next to each other.
+*/
+struct SortKey {
+    static constexpr int material_bits = 24;
+    static constexpr int vao_bits = 16;
+    static constexpr int program_bits = 16;
+
+    static constexpr int vao_shift = material_bits;
+    static constexpr int program_shift = vao_shift + vao_bits;
+    static constexpr int layer_shift = program_shift + program_bits;
+    // Commands whose keys agree above this shift share layer, program and VAO and form one batch
+    static constexpr int batch_shift = vao_shift;
+};
+struct RenderCommand {
+    uint64_t sort_key;
+    gl_ShaderProgram program;
+    gl_VAO vao;
+    Box box;
+    Color color;
+};
+/*
+Commands can be pushed from any number of threads, each push claims its own slot. Submission (sorting
+and issuing the GL calls) has to happen on the GL thread once all recording threads are done.
+*/
+struct RenderQueue {
+    std::atomic<uint32_t> n_commands = 0;
+    std::array<RenderCommand, Constants::render_queue_capacity> commands;
+    std::array<RenderCommand, Constants::render_queue_capacity> sort_buffer;
+};
+struct RenderStats {
+    int commands = 0;
+    int dropped_commands = 0;
+    int batches = 0;
+    int draw_calls = 0;
+    int state_changes = 0;
+};
+
 struct Global {
     SDL_Window *window = nullptr;
     bool running = false;
@@ -192,6 +267,9 @@ struct Global {
     glm::vec2 ball_direction = glm::normalize(glm::vec2{1.0f, -1.0f});
     float ball_speed = 0.025f;
 
+    bool autopilot = false;
+    TrajectoryPrediction prediction;
+
     int frame_counter = 0;
     std::chrono::system_clock::time_point run_start_time;
     std::chrono::system_clock::time_point frame_start_time;
@@ -202,6 +280,9 @@ struct Global {
     char gl_error_buffer[512];
 
     GameState game;
+
+    RenderQueue render_queue;
+    RenderStats render_stats;
 };
 Global global;
 
@@ -270,6 +351,13 @@ auto reset_board() -> void {
             global.game.blocks[row][col] = block;
         };
     }
+    global.prediction.valid = false;
+}
+
+auto reset_game() -> void {
+    global.game.score = 0;
+    global.game.lives = Constants::start_lives;
+    reset_board();
 }
 
 auto destroy_block(size_t row_idx, size_t col_idx) -> void {
@@ -277,6 +365,184 @@ auto destroy_block(size_t row_idx, size_t col_idx) -> void {
     if (!block.active) throw std::runtime_error("Trying to destroy inactive block!");
     block.active = false;
     global.game.score += block.value;
+
+    TrajectoryPrediction &prediction = global.prediction;
+    for (int i = 0; i < prediction.n_path_blocks; ++i) {
+        if (prediction.path_blocks[i].row == static_cast<uint8_t>(row_idx) && prediction.path_blocks[i].col == static_cast<uint8_t>(col_idx)) {
+            prediction.valid = false;
+            break;
+        }
+    }
+}
+
+auto count_active_blocks() -> int {
+    int count = 0;
+    for (const auto &row : global.game.blocks) {
+        for (const Block &block : row) {
+            if (block.active) count += 1;
+        }
+    }
+    return count;
+}
+
+/*
+Analytically traces the ball (top left corner) through wall and block reflections until it reaches the paddle.
+The ball moves `step` per tick and collisions are only checked at the end of each tick, so instead of
+intersecting rays the first tick at which the ball overlaps a wall, block or the paddle line is solved for.
+This reproduces _main_game_logic, including corner grazes it steps over, without stepping it.
+Blocks that get hit are assumed to be destroyed afterwards. Pure function of its inputs so it can be run
+for any number of independent games.
+*/
+auto predict_ball_landing(const Box &ball, glm::vec2 direction, float step, const Box &paddle, const GameState &game) -> TrajectoryPrediction {
+    constexpr float deadzone = Constants::paddle_collision_deadzone;
+    constexpr int no_hit = std::numeric_limits<int>::max();
+
+    TrajectoryPrediction prediction;
+    prediction.valid = true;
+    prediction.direction = direction;
+    prediction.step = step;
+    prediction.landing_x = ball.position.x;
+    if (step <= 0.0f) return prediction;
+
+    // First tick (>= 1) at which the ball has travelled strictly further than `distance`
+    auto first_tick_past = [step](float distance) -> int {
+        return std::max(1, static_cast<int>(std::floor(distance / step)) + 1);
+    };
+    // First tick (>= 1) at which the ball has travelled at least `distance`
+    auto first_tick_reaching = [step](float distance) -> int {
+        return std::max(1, static_cast<int>(std::ceil(distance / step)));
+    };
+
+    Position pos = ball.position;
+    glm::vec2 dir = direction;
+    for (int bounce = 0; bounce < Constants::prediction_max_bounces; ++bounce) {
+        enum class Hit { None, Landing, RightWall, LeftWall, TopWall, Block };
+        Hit hit = Hit::None;
+        int k_hit = no_hit;
+
+        // Same priority as _main_game_logic on ties: blocks, paddle, then walls in order right, left, top
+        if (dir.y < 0.0f) {
+            k_hit = first_tick_past((pos.y - ball.height - paddle.position.y) / -dir.y);
+            hit = Hit::Landing;
+        }
+        if (dir.x > 0.0f) {
+            int k = first_tick_reaching((1.0f - ball.width - pos.x) / dir.x);
+            if (k < k_hit) {
+                k_hit = k;
+                hit = Hit::RightWall;
+            }
+        } else if (dir.x < 0.0f) {
+            int k = first_tick_reaching((pos.x + 1.0f) / -dir.x);
+            if (k < k_hit) {
+                k_hit = k;
+                hit = Hit::LeftWall;
+            }
+        }
+        if (dir.y > 0.0f) {
+            int k = first_tick_reaching((1.0f - pos.y) / dir.y);
+            if (k < k_hit) {
+                k_hit = k;
+                hit = Hit::TopWall;
+            }
+        }
+        if (hit == Hit::None) break; // Ball isn't moving
+
+        // Vertical extent swept by the ball until the wall or paddle hit, used to skip entire block rows
+        const float end_y = pos.y + dir.y * step * static_cast<float>(k_hit);
+        const float sweep_top = std::max(pos.y, end_y);
+        const float sweep_bottom = std::min(pos.y, end_y) - ball.height;
+
+        int hit_row = -1;
+        int hit_col = -1;
+        for (int row = 0; row < Constants::n_block_rows; ++row) {
+            const Box &row_box = game.blocks[row][0].box;
+            if (row_box.position.y - row_box.height >= sweep_top || row_box.position.y <= sweep_bottom) continue;
+
+            for (int col = 0; col < Constants::n_block_cols; ++col) {
+                const Block &block = game.blocks[row][col];
+                if (!block.active) continue;
+                bool already_hit = false;
+                for (int i = 0; i < prediction.n_path_blocks; ++i) {
+                    if (prediction.path_blocks[i].row == row && prediction.path_blocks[i].col == col) {
+                        already_hit = true;
+                        break;
+                    }
+                }
+                if (already_hit) continue;
+
+                // Block grown by the ball size, the ball overlaps the block iff its top left corner is strictly inside
+                const float min_x = block.box.position.x - ball.width;
+                const float max_x = block.box.position.x + block.box.width;
+                const float min_y = block.box.position.y - block.box.height;
+                const float max_y = block.box.position.y + ball.height;
+
+                float t_enter = 0.0f;
+                float t_exit = std::numeric_limits<float>::infinity();
+                if (dir.x != 0.0f) {
+                    float t1 = (min_x - pos.x) / dir.x;
+                    float t2 = (max_x - pos.x) / dir.x;
+                    t_enter = std::max(t_enter, std::min(t1, t2));
+                    t_exit = std::min(t_exit, std::max(t1, t2));
+                } else if (pos.x <= min_x || pos.x >= max_x) {
+                    continue;
+                }
+                if (dir.y != 0.0f) {
+                    float t1 = (min_y - pos.y) / dir.y;
+                    float t2 = (max_y - pos.y) / dir.y;
+                    t_enter = std::max(t_enter, std::min(t1, t2));
+                    t_exit = std::min(t_exit, std::max(t1, t2));
+                } else if (pos.y <= min_y || pos.y >= max_y) {
+                    continue;
+                }
+                if (t_enter >= t_exit) continue;
+
+                int k = first_tick_past(t_enter);
+                // Strictly earlier than the best hit so far, except that blocks win ties against walls and paddle
+                bool earlier = (k < k_hit) || (k == k_hit && hit != Hit::Block);
+                if (!earlier || step * static_cast<float>(k) >= t_exit) continue;
+
+                k_hit = k;
+                hit = Hit::Block;
+                hit_row = row;
+                hit_col = col;
+            }
+        }
+
+        pos += dir * (step * static_cast<float>(k_hit));
+        switch (hit) {
+        case Hit::None:
+            break;
+        case Hit::Landing:
+            prediction.landing_x = pos.x;
+            return prediction;
+        case Hit::RightWall:
+            pos.x = 1.0f - ball.width - deadzone;
+            dir.x = -dir.x;
+            break;
+        case Hit::LeftWall:
+            pos.x = -1.0f + deadzone;
+            dir.x = -dir.x;
+            break;
+        case Hit::TopWall:
+            pos.y = 1.0f - deadzone;
+            dir.y = -dir.y;
+            break;
+        case Hit::Block: {
+            const Box &block_box = game.blocks[hit_row][hit_col].box;
+            CollisionDirection cd = collision_box_box_directional(Box{pos, ball.width, ball.height}, block_box);
+            if (cd == CollisionDirection::Left || cd == CollisionDirection::Right) {
+                dir.x = -dir.x;
+            } else {
+                dir.y = -dir.y;
+            }
+            prediction.path_blocks[prediction.n_path_blocks++] = BlockIndex{static_cast<uint8_t>(hit_row), static_cast<uint8_t>(hit_col)};
+            break;
+        }
+        }
+    }
+
+    // No landing within the bounce budget, keep the paddle under the ball for now
+    return prediction;
 }
 
 auto _main_imgui() -> void {
@@ -299,6 +565,11 @@ auto _main_imgui() -> void {
         ImGui::Text("Delta Time (ms): %lld", global.delta_time.count());
         ImGui::Text("Paddle position: %f", global.paddle.position.x);
 
+        ImGui::Text("Render Commands: %d (dropped %d)", global.render_stats.commands, global.render_stats.dropped_commands);
+        ImGui::Text("Batches: %d", global.render_stats.batches);
+        ImGui::Text("Draw Calls: %d", global.render_stats.draw_calls);
+        ImGui::Text("State Changes: %d", global.render_stats.state_changes);
+
         ImGui::End();
     } // Debug
     { // Debug::Game
@@ -306,7 +577,12 @@ auto _main_imgui() -> void {
         ImGui::Text("Lives: %d", global.game.lives);
         ImGui::Text("Score: %d", global.game.score);
         if (ImGui::Button("Reset")) {
-            reset_board();
+            reset_game();
+        }
+        ImGui::SameLine();
+        ImGui::Checkbox("Autopilot", &global.autopilot);
+        if (global.autopilot) {
+            ImGui::Text("Predicted Landing: %f", global.prediction.landing_x);
         }
 
         ImGui::PushStyleVar(ImGuiStyleVar_ItemSpacing, ImVec2(0, 0));
@@ -336,6 +612,7 @@ auto _main_imgui() -> void {
                         destroy_block(row, col);
                     } else {
                         block.active = true;
+                        global.prediction.valid = false;
                     }
                 }
 
@@ -361,6 +638,22 @@ auto move_paddle(float move_amount) -> void {
     global.paddle.position.x = glm::clamp(new_pos, -1.0f, 1.0f - global.paddle.width);
 }
 
+/*
+Moves the paddle (at most paddle_speed per tick) so that it is centered under the predicted landing point.
+The prediction is only recomputed when the ball changed direction or speed, or the board changed under it.
+*/
+auto _main_autopilot() -> void {
+    TrajectoryPrediction &prediction = global.prediction;
+    float step = global.ball_speed / (global.delta_time.count() + 1);
+    if (!prediction.valid || prediction.direction != global.ball_direction || prediction.step != step) {
+        prediction = predict_ball_landing(global.ball, global.ball_direction, step, global.paddle, global.game);
+    }
+
+    float target_x = prediction.landing_x + 0.5f * global.ball.width - 0.5f * global.paddle.width;
+    float move_amount = glm::clamp(target_x - global.paddle.position.x, -global.paddle_speed, global.paddle_speed);
+    move_paddle(move_amount);
+}
+
 auto _main_handle_inputs() -> void {
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
@@ -396,25 +689,124 @@ auto _gl_set_color_ubo(const Color color) -> void {
     glUniform3f(global.ubo.color, color.r, color.g, color.b);
 }
 
+auto make_sort_key(RenderLayer layer, gl_ShaderProgram program, gl_VAO vao, Color color) -> uint64_t {
+    // The material is the color quantized to RGB8, only used for ordering, the exact color is kept in the command
+    auto channel = [](float c) -> uint64_t {
+        return static_cast<uint64_t>(glm::clamp(c, 0.0f, 1.0f) * 255.0f + 0.5f);
+    };
+    uint64_t material = (channel(color.r) << 16) | (channel(color.g) << 8) | channel(color.b);
+
+    constexpr uint64_t program_mask = (uint64_t{1} << SortKey::program_bits) - 1;
+    constexpr uint64_t vao_mask = (uint64_t{1} << SortKey::vao_bits) - 1;
+    return (static_cast<uint64_t>(layer) << SortKey::layer_shift) |
+           ((static_cast<uint64_t>(program) & program_mask) << SortKey::program_shift) |
+           ((static_cast<uint64_t>(vao) & vao_mask) << SortKey::vao_shift) |
+           material;
+}
+
+/*
+Thread safe, commands beyond Constants::render_queue_capacity are dropped and reported in the render stats.
+*/
+auto render_queue_push(RenderLayer layer, gl_ShaderProgram program, gl_VAO vao, const Box &box, Color color) -> void {
+    RenderQueue &queue = global.render_queue;
+    uint32_t idx = queue.n_commands.fetch_add(1, std::memory_order_relaxed);
+    if (idx >= Constants::render_queue_capacity) return;
+    queue.commands[idx] = RenderCommand{make_sort_key(layer, program, vao, color), program, vao, box, color};
+}
+
+/*
+Stable LSD radix sort on the 64 bit sort keys, one byte per pass. Passes in which all keys share the same
+byte are skipped, which for this game are most of them. Returns whichever of the two buffers holds the result.
+*/
+auto radix_sort_render_commands(RenderCommand *commands, RenderCommand *scratch, uint32_t n) -> RenderCommand * {
+    RenderCommand *src = commands;
+    RenderCommand *dst = scratch;
+    for (int shift = 0; shift < 64; shift += 8) {
+        std::array<uint32_t, 256> offsets{};
+        for (uint32_t i = 0; i < n; ++i) {
+            offsets[(src[i].sort_key >> shift) & 0xFF] += 1;
+        }
+        if (offsets[(src[0].sort_key >> shift) & 0xFF] == n) continue;
+
+        uint32_t total = 0;
+        for (uint32_t &offset : offsets) {
+            uint32_t count = offset;
+            offset = total;
+            total += count;
+        }
+        for (uint32_t i = 0; i < n; ++i) {
+            dst[offsets[(src[i].sort_key >> shift) & 0xFF]++] = src[i];
+        }
+        std::swap(src, dst);
+    }
+    return src;
+}
+
+/*
+Sorts the recorded commands and issues them, skipping program, VAO and color changes that would be redundant.
+Has to be called on the GL thread after all recording is done, empties the queue.
+*/
+auto render_queue_submit() -> void {
+    RenderQueue &queue = global.render_queue;
+    uint32_t n_recorded = queue.n_commands.load(std::memory_order_relaxed);
+    uint32_t n = std::min(n_recorded, Constants::render_queue_capacity);
+
+    RenderStats stats;
+    stats.commands = static_cast<int>(n);
+    stats.dropped_commands = static_cast<int>(n_recorded - n);
+
+    if (n > 0) {
+        RenderCommand *sorted = radix_sort_render_commands(queue.commands.data(), queue.sort_buffer.data(), n);
+
+        gl_ShaderProgram bound_program = 0;
+        gl_VAO bound_vao = 0;
+        bool color_set = false;
+        Color bound_color;
+        for (uint32_t i = 0; i < n; ++i) {
+            const RenderCommand &cmd = sorted[i];
+            if (i == 0 || (cmd.sort_key >> SortKey::batch_shift) != (sorted[i - 1].sort_key >> SortKey::batch_shift)) {
+                stats.batches += 1;
+            }
+            if (cmd.program != bound_program) {
+                glUseProgram(cmd.program);
+                glUniform1f(global.ubo.time, (float)global.runtime.count());
+                bound_program = cmd.program;
+                color_set = false; // Uniforms are per program
+                stats.state_changes += 1;
+            }
+            if (cmd.vao != bound_vao) {
+                glBindVertexArray(cmd.vao);
+                bound_vao = cmd.vao;
+                stats.state_changes += 1;
+            }
+            if (!color_set || cmd.color != bound_color) {
+                _gl_set_color_ubo(cmd.color);
+                bound_color = cmd.color;
+                color_set = true;
+                stats.state_changes += 1;
+            }
+
+            _gl_set_box_ubo(cmd.box);
+            glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+            stats.draw_calls += 1;
+        }
+        glBindVertexArray(0);
+    }
+
+    queue.n_commands.store(0, std::memory_order_relaxed);
+    global.render_stats = stats;
+}
+
 auto _main_render() -> void {
     glViewport(0, 0, (int)global.imgui_io.DisplaySize.x, (int)global.imgui_io.DisplaySize.y);
     glClearColor(global.color.background.r, global.color.background.g, global.color.background.b, 1.0f);
     glClear(GL_COLOR_BUFFER_BIT);
 
-    glUseProgram(global.shader_program);
-    glBindVertexArray(global.paddle_vao);
-
-    glUniform1f(global.ubo.time, (float)global.runtime.count());
-
     { // Paddle
-        _gl_set_box_ubo(global.paddle);
-        _gl_set_color_ubo(global.color.paddle);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        render_queue_push(RenderLayer::Paddle, global.shader_program, global.paddle_vao, global.paddle, global.color.paddle);
     }
     { // Ball
-        _gl_set_box_ubo(global.ball);
-        _gl_set_color_ubo(global.color.ball);
-        glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+        render_queue_push(RenderLayer::Ball, global.shader_program, global.paddle_vao, global.ball, global.color.ball);
     }
 
     { // Blocks
@@ -422,15 +814,13 @@ auto _main_render() -> void {
             for (size_t col = 0; col < Constants::n_block_cols; ++col) {
                 Block &block = global.game.blocks[row][col];
                 if (block.active) {
-                    _gl_set_box_ubo(block.box);
-                    _gl_set_color_ubo(block.color);
-                    glDrawElements(GL_TRIANGLES, 6, GL_UNSIGNED_INT, 0);
+                    render_queue_push(RenderLayer::Blocks, global.shader_program, global.paddle_vao, block.box, block.color);
                 }
             }
         }
     }
 
-    glBindVertexArray(0);
+    render_queue_submit();
 }
 
 /*
@@ -619,6 +1009,12 @@ void _main_game_logic() {
 
     // Paddle Collision
     CollisionDirection cd = collision_box_box_directional(global.ball, global.paddle);
+    // With the paddle at a wall there is no room beside it, bouncing off the side would push the ball out of the field
+    bool no_room_left = global.paddle.position.x - global.ball.width - deadzone <= -1.0f;
+    bool no_room_right = global.paddle.position.x + global.paddle.width + global.ball.width + deadzone >= 1.0f;
+    if ((cd == CollisionDirection::Left && no_room_left) || (cd == CollisionDirection::Right && no_room_right)) {
+        cd = CollisionDirection::Top;
+    }
     if (cd != CollisionDirection::None) {
         switch (cd) {
         case CollisionDirection::None:
@@ -660,10 +1056,44 @@ void _main_game_logic() {
     } else if (ball_touched_bottom_wall) {
         global.ball.position.y = -1.0f + +global.ball.height + deadzone;
         global.ball_direction.y = -global.ball_direction.y;
+        global.game.lives -= 1;
+        if (global.game.lives <= 0) reset_game(); // Game over
     }
 }
 
+/*
+Runs the game logic without any window or GL context, with the autopilot moving the paddle, until the
+board is cleared. Returns true if that happened without losing a life.
+*/
+auto run_headless() -> bool {
+    reset_game();
+    global.autopilot = true;
+    global.delta_time = std::chrono::milliseconds(0);
+
+    const int start_lives = global.game.lives;
+    while (global.frame_counter < Constants::headless_max_ticks && count_active_blocks() > 0 && global.game.lives == start_lives) {
+        _main_autopilot();
+        _main_game_logic();
+        global.frame_counter += 1;
+    }
+
+    int remaining_blocks = count_active_blocks();
+    std::cout << "Headless run finished after " << global.frame_counter << " ticks: "
+              << "score " << global.game.score << ", lives " << global.game.lives << ", "
+              << remaining_blocks << " blocks remaining\n";
+    return remaining_blocks == 0 && global.game.lives == start_lives;
+}
+
 auto main(int argc, char **argv) -> int {
+    for (int i = 1; i < argc; ++i) {
+        if (std::string_view(argv[i]) == "--headless") {
+            return run_headless() ? EXIT_SUCCESS : EXIT_FAILURE;
+        }
+        if (std::string_view(argv[i]) == "--autopilot") {
+            global.autopilot = true;
+        }
+    }
+
     if (!setup()) panic("Setup failed!");
 
     setup_shader_program();
@@ -682,6 +1112,7 @@ auto main(int argc, char **argv) -> int {
         global.runtime = std::chrono::duration_cast<std::chrono::milliseconds>(global.frame_start_time - global.run_start_time);
 
         _main_handle_inputs();
+        if (global.autopilot) _main_autopilot();
         _main_game_logic();
 
         _main_imgui();